@@ -0,0 +1,92 @@
+// analog.c - Analog clock face implementation
+#include "analog.h"
+#include "config.h"
+#include "colors.h"
+
+#include <graphx.h>
+
+// sin(i * 6 degrees) * 127 for each minute mark; cos(i) is sin(i + 15)
+static const int8_t sin_table[60] = {
+       0,   13,   26,   39,   52,   64,   75,   85,   94,  103,
+     110,  116,  121,  124,  126,  127,  126,  124,  121,  116,
+     110,  103,   94,   85,   75,   64,   52,   39,   26,   13,
+       0,  -13,  -26,  -39,  -52,  -64,  -75,  -85,  -94, -103,
+    -110, -116, -121, -124, -126, -127, -126, -124, -121, -116,
+    -110, -103,  -94,  -85,  -75,  -64,  -52,  -39,  -26,  -13
+};
+
+// Hour mark endpoints: [mark][inner, outer]
+static int16_t mark_x[12][2];
+static int16_t mark_y[12][2];
+
+// Hand endpoints, only recomputed when the minute changes
+static int16_t hour_x, hour_y;
+static int16_t min_x, min_y;
+static uint8_t cached_mins = 0xFF;
+static uint8_t cached_hours = 0xFF;
+
+// Offset from the dial center for a minute mark at the given length
+// (divide rather than shift so left/up hands aren't a pixel longer)
+static int16_t hand_dx(uint8_t pos, uint8_t len)
+{
+    return ((int16_t)sin_table[pos] * len) / 127;
+}
+
+static int16_t hand_dy(uint8_t pos, uint8_t len)
+{
+    return -(((int16_t)sin_table[(pos + 15) % 60] * len) / 127);
+}
+
+// Dial face, rim and hour marks
+static void draw_dial(void)
+{
+    uint8_t i;
+
+    gfx_SetColor(COLOR_DIAL_FACE);
+    gfx_FillCircle(ANALOG_CENTER_X, ANALOG_CENTER_Y, ANALOG_RADIUS);
+    gfx_SetColor(COLOR_DIAL_RIM);
+    gfx_Circle(ANALOG_CENTER_X, ANALOG_CENTER_Y, ANALOG_RADIUS);
+
+    gfx_SetColor(COLOR_DIAL_MARK);
+    for (i = 0; i < 12; i++) {
+        gfx_Line(mark_x[i][0], mark_y[i][0], mark_x[i][1], mark_y[i][1]);
+    }
+}
+
+void analog_init(void)
+{
+    uint8_t i;
+
+    // Hour mark endpoints never change, so work them out once
+    for (i = 0; i < 60; i += 5) {
+        uint8_t inner = (i % 15 == 0) ? ANALOG_RADIUS - 8 : ANALOG_RADIUS - 5;
+        mark_x[i / 5][0] = ANALOG_CENTER_X + hand_dx(i, inner);
+        mark_y[i / 5][0] = ANALOG_CENTER_Y + hand_dy(i, inner);
+        mark_x[i / 5][1] = ANALOG_CENTER_X + hand_dx(i, ANALOG_RADIUS - 2);
+        mark_y[i / 5][1] = ANALOG_CENTER_Y + hand_dy(i, ANALOG_RADIUS - 2);
+    }
+}
+
+void analog_draw(uint8_t hours, uint8_t mins)
+{
+    if (mins != cached_mins || hours != cached_hours) {
+        // Hour hand moves one mark every 12 minutes
+        uint8_t hour_pos = (hours % 12) * 5 + mins / 12;
+
+        hour_x = ANALOG_CENTER_X + hand_dx(hour_pos, ANALOG_HOUR_LEN);
+        hour_y = ANALOG_CENTER_Y + hand_dy(hour_pos, ANALOG_HOUR_LEN);
+        min_x = ANALOG_CENTER_X + hand_dx(mins, ANALOG_MINUTE_LEN);
+        min_y = ANALOG_CENTER_Y + hand_dy(mins, ANALOG_MINUTE_LEN);
+        cached_mins = mins;
+        cached_hours = hours;
+    }
+
+    draw_dial();
+
+    // Hands (hour hand doubled for thickness)
+    gfx_SetColor(COLOR_HAND);
+    gfx_Line(ANALOG_CENTER_X, ANALOG_CENTER_Y, hour_x, hour_y);
+    gfx_Line(ANALOG_CENTER_X + 1, ANALOG_CENTER_Y, hour_x + 1, hour_y);
+    gfx_Line(ANALOG_CENTER_X, ANALOG_CENTER_Y, min_x, min_y);
+    gfx_FillCircle(ANALOG_CENTER_X, ANALOG_CENTER_Y, 2);
+}
@@ -0,0 +1,13 @@
+// analog.h - Analog clock face
+#ifndef ANALOG_H
+#define ANALOG_H
+
+#include <stdint.h>
+
+// Precompute the dial hour marks (call once at startup)
+void analog_init(void);
+
+// Draw the dial and hands for the given time
+void analog_draw(uint8_t hours, uint8_t mins);
+
+#endif
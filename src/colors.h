@@ -32,6 +32,12 @@
 #define COLOR_STAR_BRIGHT   0xE7
 #define COLOR_STAR_DIM      0xA4
 
+// Analog clock colors
+#define COLOR_DIAL_FACE     0xFF
+#define COLOR_DIAL_RIM      COLOR_PURPLE_DARK
+#define COLOR_DIAL_MARK     0x00
+#define COLOR_HAND          0x00
+
 // Text colors for day/night
 #define COLOR_TEXT_LIGHT    0xFE
 #define COLOR_TEXT_DARK     0x00
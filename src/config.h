@@ -16,8 +16,39 @@
 // Animation timing
 #define FRAME_DELAY_MS  200
 
+// Power management
+#define POWER_IDLE_SECONDS  120  // No keypress for this long dims the screen
+#define POWER_DIM_LEVEL     230  // Backlight level when idle (0 = brightest)
+#define POWER_DIM_STEP      8    // Backlight ramp per frame while dimming
+#define POWER_POLL_MS       250  // Key/RTC poll interval while idle
+
+// Clock faces
+#define CLOCK_FACE_DIGITAL  0
+#define CLOCK_FACE_ANALOG   1
+
+// Analog clock geometry
+#define ANALOG_CENTER_X     160
+#define ANALOG_CENTER_Y     128
+#define ANALOG_RADIUS       36
+#define ANALOG_HOUR_LEN     20
+#define ANALOG_MINUTE_LEN   31
+
+// Persistent settings
+#define SETTINGS_APPVAR     "CLOCKCFG"
+#define SETTINGS_VERSION    1
+
+// Scenery ground line (built-in theme) and the range a theme may move it in
+#define GROUND_Y            225
+#define THEME_GROUND_MIN    200
+#define THEME_GROUND_MAX    232
+
+// Theme packs
+#define THEME_MAGIC         "CLTH"
+#define THEME_VERSION       1
+#define THEME_DATA_MAX      4096  // Largest decompressed theme (data + sprite)
+
 // Weather system
-#define MAX_PARTICLES   18
+#define MAX_PARTICLES   36
 #define MAX_STARS       1
 #define WEATHER_NONE    0
 #define WEATHER_SNOW    1
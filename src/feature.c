@@ -2,70 +2,75 @@
 #include "feature.h"
 #include "config.h"
 #include "colors.h"
+#include "theme.h"
 
 #include <graphx.h>
 
 void feature_draw(uint8_t frame)
 {
+    // Sit on the theme's ground line
+    int16_t base_y = CAT_BASE_Y + theme_ground_offset();
+
     // Calculate breathing effect: oscillates between -1 and +1
     int8_t breath = ((frame / 4) % 20 < 10) ? ((frame / 4) % 10) / 5 : (9 - ((frame / 4) % 10)) / 5;
     
     // Body segments (back to front, so front overlaps)
     // Segment 4 (tail)
     gfx_SetColor(COLOR_PURPLE_DARK);
-    gfx_Circle(CAT_BASE_X + 38, CAT_BASE_Y + 8, 12 + breath);
+    gfx_Circle(CAT_BASE_X + 38, base_y + 8, 12 + breath);
     gfx_SetColor(COLOR_PURPLE_LIGHT);
-    gfx_FillCircle(CAT_BASE_X + 38, CAT_BASE_Y + 8, 11 + breath);
+    gfx_FillCircle(CAT_BASE_X + 38, base_y + 8, 11 + breath);
 
     // Segment 3
     gfx_SetColor(COLOR_PURPLE_DARK);
-    gfx_Circle(CAT_BASE_X + 22, CAT_BASE_Y + 4, 14 + breath);
+    gfx_Circle(CAT_BASE_X + 22, base_y + 4, 14 + breath);
     gfx_SetColor(COLOR_PURPLE_LIGHT);
-    gfx_FillCircle(CAT_BASE_X + 22, CAT_BASE_Y + 4, 13 + breath);
+    gfx_FillCircle(CAT_BASE_X + 22, base_y + 4, 13 + breath);
 
     // Segment 2
     gfx_SetColor(COLOR_PURPLE_DARK);
-    gfx_Circle(CAT_BASE_X + 4, CAT_BASE_Y + 2, 16 + breath);
+    gfx_Circle(CAT_BASE_X + 4, base_y + 2, 16 + breath);
     gfx_SetColor(COLOR_PURPLE_LIGHT);
-    gfx_FillCircle(CAT_BASE_X + 4, CAT_BASE_Y + 2, 15 + breath);
+    gfx_FillCircle(CAT_BASE_X + 4, base_y + 2, 15 + breath);
 
     // Head (segment 1)
     gfx_SetColor(COLOR_PURPLE_DARK);
-    gfx_Circle(CAT_BASE_X - 16, CAT_BASE_Y + 2, 18 + breath);
+    gfx_Circle(CAT_BASE_X - 16, base_y + 2, 18 + breath);
     gfx_SetColor(COLOR_PURPLE_LIGHT);
-    gfx_FillCircle(CAT_BASE_X - 16, CAT_BASE_Y + 2, 17 + breath);
+    gfx_FillCircle(CAT_BASE_X - 16, base_y + 2, 17 + breath);
 
     // Antennae
     gfx_SetColor(COLOR_PURPLE_DARK);
-    gfx_Line(CAT_BASE_X - 24, CAT_BASE_Y - 14, CAT_BASE_X - 28, CAT_BASE_Y - 26);
-    gfx_FillCircle(CAT_BASE_X - 28, CAT_BASE_Y - 27, 3);
-    gfx_Line(CAT_BASE_X - 10, CAT_BASE_Y - 14, CAT_BASE_X - 6, CAT_BASE_Y - 26);
-    gfx_FillCircle(CAT_BASE_X - 6, CAT_BASE_Y - 27, 3);
+    gfx_Line(CAT_BASE_X - 24, base_y - 14, CAT_BASE_X - 28, base_y - 26);
+    gfx_FillCircle(CAT_BASE_X - 28, base_y - 27, 3);
+    gfx_Line(CAT_BASE_X - 10, base_y - 14, CAT_BASE_X - 6, base_y - 26);
+    gfx_FillCircle(CAT_BASE_X - 6, base_y - 27, 3);
 
     // Closed eyes (sleeping) - horizontal lines
     gfx_SetColor(COLOR_PURPLE_DARK);
-    gfx_HorizLine(CAT_BASE_X - 24, CAT_BASE_Y, 6);
-    gfx_HorizLine(CAT_BASE_X - 12, CAT_BASE_Y, 6);
+    gfx_HorizLine(CAT_BASE_X - 24, base_y, 6);
+    gfx_HorizLine(CAT_BASE_X - 12, base_y, 6);
 
     // Blush marks
     gfx_SetColor(COLOR_PINK);
-    gfx_FillCircle(CAT_BASE_X - 26, CAT_BASE_Y + 6, 2);
-    gfx_FillCircle(CAT_BASE_X - 6, CAT_BASE_Y + 6, 2);
+    gfx_FillCircle(CAT_BASE_X - 26, base_y + 6, 2);
+    gfx_FillCircle(CAT_BASE_X - 6, base_y + 6, 2);
 
     // Little feet
     gfx_SetColor(COLOR_PURPLE_DARK);
-    gfx_FillCircle(CAT_BASE_X + 32, CAT_BASE_Y + 18, 2);
-    gfx_FillCircle(CAT_BASE_X + 44, CAT_BASE_Y + 18, 2);
-    gfx_FillCircle(CAT_BASE_X + 16, CAT_BASE_Y + 16, 2);
-    gfx_FillCircle(CAT_BASE_X + 28, CAT_BASE_Y + 16, 2);
+    gfx_FillCircle(CAT_BASE_X + 32, base_y + 18, 2);
+    gfx_FillCircle(CAT_BASE_X + 44, base_y + 18, 2);
+    gfx_FillCircle(CAT_BASE_X + 16, base_y + 16, 2);
+    gfx_FillCircle(CAT_BASE_X + 28, base_y + 16, 2);
 }
 
 void feature_draw_zzz(uint8_t frame)
 {
+    int16_t base_y = CAT_BASE_Y + theme_ground_offset();
     uint8_t offset = (frame / 2) % 12;
 
     gfx_SetColor(COLOR_PURPLE_DARK);
-    gfx_PrintStringXY("z", CAT_BASE_X - 38, CAT_BASE_Y - 34 - offset);
-    gfx_PrintStringXY("z", CAT_BASE_X - 46, CAT_BASE_Y - 44 - offset);
-    gfx_PrintStringXY("Z", CAT_BASE_X - 54, CAT_BASE_Y - 56 - offset);
+    gfx_PrintStringXY("z", CAT_BASE_X - 38, base_y - 34 - offset);
+    gfx_PrintStringXY("z", CAT_BASE_X - 46, base_y - 44 - offset);
+    gfx_PrintStringXY("Z", CAT_BASE_X - 54, base_y - 56 - offset);
 }
@@ -15,6 +15,10 @@
 #include "weather.h"
 #include "scene.h"
 #include "feature.h"
+#include "power.h"
+#include "analog.h"
+#include "settings.h"
+#include "theme.h"
 
 static const char* quotes[] = {
     "Richard M. Stallman: Free software is a matter of liberty, not price. To understand the concept, you should think of 'free' as in 'free speech,' not as in 'free beer.'",
@@ -110,14 +114,22 @@ int main(void)
     uint8_t frame = 0;
     uint8_t weather;
     uint8_t night;
+    uint8_t theme_changed;
     int8_t night_override = -1;  // -1 = auto, 0 = force day, 1 = force night
     uint8_t show_quote = 0;      // 0 = battery/RAM, 1 = quote
     uint8_t current_quote = 0;
     uint8_t left_pressed = 0, right_pressed = 0;
+    uint8_t mode_pressed = 0;
+    settings_t settings;
+    uint8_t saved_face;
     char buf[32];
 
     gfx_Begin();
     gfx_SetDrawBuffer();
+    power_init();
+    settings_load(&settings);
+    saved_face = settings.clock_face;
+    analog_init();
 
     // Select random quote on startup
     current_quote = simple_rand() % QUOTE_COUNT;
@@ -126,6 +138,9 @@ int main(void)
         boot_GetDate(&day, &month, &year);
         boot_GetTime(&secs, &mins, &hours);
 
+        // Switch seasonal theme when the month changes
+        theme_changed = theme_update(month);
+
         // Check if it's nighttime (use override if set, otherwise auto)
         if (night_override >= 0) {
             night = night_override;
@@ -133,8 +148,9 @@ int main(void)
             night = is_nighttime(hours);
         }
 
-        // Initialize particles and weather on first run
-        if (!weather_is_initialized()) {
+        // Initialize particles and weather on first run, and again when
+        // a new theme brings its own weather odds and particle speeds
+        if (!weather_is_initialized() || theme_changed) {
             weather = weather_get_random_type();
             weather_init();
         }
@@ -146,16 +162,16 @@ int main(void)
 
         // Fill screen with appropriate background color
         if (night) {
-            gfx_FillScreen(COLOR_NIGHT_SKY);
+            gfx_FillScreen(theme_get()->sky_night);
         } else {
-            gfx_FillScreen(COLOR_SKY_BLUE);
+            gfx_FillScreen(theme_get()->sky_day);
         }
 
         // Draw scene background
         scene_draw(night, frame);
 
-        // Draw weather effects
-        weather_draw(weather, frame);
+        // Draw weather effects (frozen while idle)
+        weather_draw(weather, frame, !power_is_idle());
 
         // Draw date and time - white text at night, black during day
         if (night) {
@@ -209,10 +225,16 @@ int main(void)
         gfx_SetTextScale(4, 4);
         sprintf(buf, "%02d/%02d/%04d", month, day, year);
         gfx_PrintStringXY(buf, (SCREEN_WIDTH - gfx_GetStringWidth(buf)) / 2, 60);
-        sprintf(buf, "%02d:%02d", hours, mins);
-        gfx_PrintStringXY(buf, (SCREEN_WIDTH - gfx_GetStringWidth(buf)) / 2, 110);
+        if (settings.clock_face == CLOCK_FACE_DIGITAL) {
+            sprintf(buf, "%02d:%02d", hours, mins);
+            gfx_PrintStringXY(buf, (SCREEN_WIDTH - gfx_GetStringWidth(buf)) / 2, 110);
+        }
         gfx_SetTextScale(1, 1);
 
+        if (settings.clock_face == CLOCK_FACE_ANALOG) {
+            analog_draw(hours, mins);
+        }
+
         // Draw sleeping feature animation
         feature_draw(frame);
         feature_draw_zzz(frame);
@@ -220,6 +242,7 @@ int main(void)
         gfx_SwapDraw();
 
         kb_Scan();
+        power_update();
         if (kb_Data[6] & kb_Clear) {
             break;
         }
@@ -261,10 +284,32 @@ int main(void)
             right_pressed = 0;
         }
 
-        frame++;
+        // Mode = toggle between digital and analog clock face
+        if (kb_Data[1] & kb_Mode) {
+            if (!mode_pressed) {
+                settings.clock_face = !settings.clock_face;
+                mode_pressed = 1;
+            }
+        } else {
+            mode_pressed = 0;
+        }
+
+        // When idle, hold the last frame until the minute changes or a key is pressed
+        if (power_is_idle()) {
+            power_wait(mins);
+        } else {
+            frame++;
+        }
         // delay(FRAME_DELAY_MS);
     }
 
+    power_restore();
     gfx_End();
+
+    // Only touch flash if something changed, and after leaving graphx
+    // (archiving can bring up the OS garbage collect prompt)
+    if (settings.clock_face != saved_face) {
+        settings_save(&settings);
+    }
     return 0;
 }
@@ -0,0 +1,96 @@
+// power.c - Idle power management implementation
+#include "power.h"
+#include "config.h"
+
+#include <keypadc.h>
+#include <sys/lcd.h>
+#include <sys/power.h>
+#include <sys/rtc.h>
+#include <sys/timers.h>
+
+#define POWER_STATE_ACTIVE  0
+#define POWER_STATE_DIMMING 1
+#define POWER_STATE_IDLE    2
+
+static uint8_t saved_backlight;
+static uint8_t power_state = POWER_STATE_ACTIVE;
+static uint32_t last_activity;
+
+// Put the screen back to full brightness and reset the idle timer
+static void power_wake(void)
+{
+    lcd_BacklightLevel = saved_backlight;
+    power_state = POWER_STATE_ACTIVE;
+    last_activity = rtc_Time();
+}
+
+void power_init(void)
+{
+    saved_backlight = lcd_BacklightLevel;
+    power_state = POWER_STATE_ACTIVE;
+    last_activity = rtc_Time();
+}
+
+void power_restore(void)
+{
+    boot_Set48MHzMode();
+    lcd_BacklightLevel = saved_backlight;
+}
+
+void power_update(void)
+{
+    if (kb_AnyKey()) {
+        if (power_state != POWER_STATE_ACTIVE) {
+            power_wake();
+        }
+        last_activity = rtc_Time();
+        return;
+    }
+
+    switch (power_state) {
+        case POWER_STATE_ACTIVE:
+            if (rtc_Time() - last_activity >= POWER_IDLE_SECONDS) {
+                power_state = POWER_STATE_DIMMING;
+            }
+            break;
+        case POWER_STATE_DIMMING:
+            // Higher level = dimmer; ramp a step per frame down to the floor
+            if (lcd_BacklightLevel >= POWER_DIM_LEVEL) {
+                power_state = POWER_STATE_IDLE;
+            } else if (POWER_DIM_LEVEL - lcd_BacklightLevel <= POWER_DIM_STEP) {
+                lcd_BacklightLevel = POWER_DIM_LEVEL;
+                power_state = POWER_STATE_IDLE;
+            } else {
+                lcd_BacklightLevel += POWER_DIM_STEP;
+            }
+            break;
+    }
+}
+
+uint8_t power_is_idle(void)
+{
+    return power_state == POWER_STATE_IDLE;
+}
+
+void power_wait(uint8_t mins)
+{
+    uint8_t secs, now_mins, hours;
+
+    // Nothing on screen changes until the next minute, so run slow
+    boot_Set6MHzMode();
+    do {
+        delay(POWER_POLL_MS);
+        kb_Scan();
+        boot_GetTime(&secs, &now_mins, &hours);
+    } while (!kb_AnyKey() && now_mins == mins);
+    boot_Set48MHzMode();
+
+    if (kb_AnyKey()) {
+        power_wake();
+
+        // Swallow the wake key so the main loop doesn't act on it
+        do {
+            kb_Scan();
+        } while (kb_AnyKey());
+    }
+}
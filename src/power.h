@@ -0,0 +1,23 @@
+// power.h - Idle power management (backlight dimming, minute-tick wake-up)
+#ifndef POWER_H
+#define POWER_H
+
+#include <stdint.h>
+
+// Remember the user's backlight level and start the idle timer
+void power_init(void);
+
+// Restore the original backlight level and CPU speed (call before exit)
+void power_restore(void);
+
+// Call once per frame after kb_Scan(); handles idle timeout and dimming ramp
+void power_update(void);
+
+// Check if the screensaver is idle (dimmed, animations stopped)
+uint8_t power_is_idle(void);
+
+// Block at low CPU speed until the RTC minute changes or a key is pressed
+// (a wake key is waited out until released, so it isn't acted on)
+void power_wait(uint8_t mins);
+
+#endif
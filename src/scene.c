@@ -3,19 +3,20 @@
 #include "config.h"
 #include "colors.h"
 #include "weather.h"
+#include "theme.h"
 
 #include <graphx.h>
 
 static void draw_clouds(void)
 {
     // Cloud 1 - top left area
-    gfx_SetColor(COLOR_CLOUD_WHITE);
+    gfx_SetColor(theme_get()->cloud);
     gfx_FillCircle(35, 35, 14);
     gfx_FillCircle(55, 32, 16);
     gfx_FillCircle(75, 35, 12);
 
     // Cloud 2 - top right area (smaller)
-    gfx_SetColor(COLOR_CLOUD_WHITE);
+    gfx_SetColor(theme_get()->cloud);
     gfx_FillCircle(250, 48, 10);
     gfx_FillCircle(268, 48, 9);
     gfx_FillCircle(259, 44, 8);
@@ -23,43 +24,48 @@ static void draw_clouds(void)
 
 static void draw_ground(void)
 {
+    const theme_t *theme = theme_get();
+    uint8_t top = theme->ground_y;
+
     // Main ground line
-    gfx_SetColor(COLOR_GRASS_GREEN);
-    gfx_FillRectangle(0, 225, SCREEN_WIDTH, 15);
+    gfx_SetColor(theme->grass);
+    gfx_FillRectangle(0, top, SCREEN_WIDTH, SCREEN_HEIGHT - top);
 
     // Grass tufts - small triangular blades
-    gfx_SetColor(COLOR_GRASS_LIGHT);
+    gfx_SetColor(theme->grass_light);
     uint16_t i;
     for (i = 5; i < SCREEN_WIDTH; i += 15) {
-        gfx_Line(i, 225, i + 3, 218);
-        gfx_Line(i + 3, 218, i + 6, 225);
-        gfx_Line(i + 8, 225, i + 10, 220);
-        gfx_Line(i + 10, 220, i + 12, 225);
+        gfx_Line(i, top, i + 3, top - 7);
+        gfx_Line(i + 3, top - 7, i + 6, top);
+        gfx_Line(i + 8, top, i + 10, top - 5);
+        gfx_Line(i + 10, top - 5, i + 12, top);
     }
 }
 
 static void draw_tree(int16_t x, int16_t y, uint8_t size)
 {
     // Tree trunk
-    gfx_SetColor(COLOR_TREE_TRUNK);
+    gfx_SetColor(theme_get()->tree_trunk);
     gfx_FillRectangle(x - size/4, y, size/2, size + size/2);
 
     // Tree foliage - layered circles
-    gfx_SetColor(COLOR_TREE_LEAVES);
+    gfx_SetColor(theme_get()->tree_leaves);
     gfx_FillCircle(x, y - size/2, size);
     gfx_FillCircle(x - size/2, y - size/4, size * 3/4);
     gfx_FillCircle(x + size/2, y - size/4, size * 3/4);
 
     // Highlight
-    gfx_SetColor(COLOR_TREE_LIGHT);
+    gfx_SetColor(theme_get()->tree_light);
     gfx_FillCircle(x - size/4, y - size/2 - size/4, size/2);
 }
 
 static void draw_trees(void)
 {
+    int8_t shift = theme_ground_offset();
+
     // Left side trees
-    draw_tree(30, 200, 20);
-    draw_tree(70, 213, 14);
+    draw_tree(30, 200 + shift, 20);
+    draw_tree(70, 213 + shift, 14);
 }
 
 static void draw_flower(int16_t x, int16_t y, uint16_t color)
@@ -71,16 +77,18 @@ static void draw_flower(int16_t x, int16_t y, uint16_t color)
     gfx_FillCircle(x, y - 3, 2);
     gfx_FillCircle(x, y + 3, 2);
     // Center
-    gfx_SetColor(COLOR_FLOWER_CENTER);
+    gfx_SetColor(theme_get()->flower_center);
     gfx_FillCircle(x, y, 2);
 }
 
 static void draw_flowers(void)
 {
-    draw_flower(100, 218, COLOR_FLOWER_RED);
-    draw_flower(130, 220, COLOR_FLOWER_YELLOW);
-    draw_flower(160, 217, COLOR_FLOWER_RED);
-    draw_flower(200, 219, COLOR_FLOWER_YELLOW);
+    int8_t shift = theme_ground_offset();
+
+    draw_flower(100, 218 + shift, theme_get()->flower_red);
+    draw_flower(130, 220 + shift, theme_get()->flower_yellow);
+    draw_flower(160, 217 + shift, theme_get()->flower_red);
+    draw_flower(200, 219 + shift, theme_get()->flower_yellow);
 }
 
 void scene_draw(uint8_t is_night, uint8_t frame)
@@ -93,4 +101,12 @@ void scene_draw(uint8_t is_night, uint8_t frame)
     draw_trees();
     draw_ground();
     draw_flowers();
+
+    // Theme decoration (e.g. pumpkin, snowman)
+    if (theme_sprite() != NULL) {
+        const theme_t *theme = theme_get();
+        uint8_t old_transparent = gfx_SetTransparentColor(theme->sprite_transparent);
+        gfx_TransparentSprite(theme_sprite(), theme->sprite_x, theme->sprite_y);
+        gfx_SetTransparentColor(old_transparent);
+    }
 }
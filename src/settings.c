@@ -0,0 +1,43 @@
+// settings.c - Persistent user settings implementation
+#include "settings.h"
+#include "config.h"
+
+#include <fileioc.h>
+
+static void settings_default(settings_t *settings)
+{
+    settings->version = SETTINGS_VERSION;
+    settings->clock_face = CLOCK_FACE_DIGITAL;
+}
+
+void settings_load(settings_t *settings)
+{
+    uint8_t handle;
+
+    settings_default(settings);
+
+    handle = ti_Open(SETTINGS_APPVAR, "r");
+    if (!handle) {
+        return;
+    }
+
+    // Ignore short reads and settings written by another version
+    if (ti_Read(settings, sizeof(settings_t), 1, handle) != 1 ||
+        settings->version != SETTINGS_VERSION ||
+        settings->clock_face > CLOCK_FACE_ANALOG) {
+        settings_default(settings);
+    }
+    ti_Close(handle);
+}
+
+void settings_save(const settings_t *settings)
+{
+    uint8_t handle = ti_Open(SETTINGS_APPVAR, "w");
+    if (!handle) {
+        return;
+    }
+
+    ti_Write(settings, sizeof(settings_t), 1, handle);
+    ti_SetArchiveStatus(true, handle);
+    ti_Close(handle);
+}
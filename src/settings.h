@@ -0,0 +1,18 @@
+// settings.h - Persistent user settings (stored in an AppVar)
+#ifndef SETTINGS_H
+#define SETTINGS_H
+
+#include <stdint.h>
+
+typedef struct {
+    uint8_t version;
+    uint8_t clock_face;  // CLOCK_FACE_DIGITAL or CLOCK_FACE_ANALOG
+} settings_t;
+
+// Load settings from the AppVar, falling back to defaults
+void settings_load(settings_t *settings);
+
+// Save settings to the AppVar and archive it
+void settings_save(const settings_t *settings);
+
+#endif
@@ -0,0 +1,274 @@
+// theme.c - Seasonal scene theme implementation
+#include "theme.h"
+#include "config.h"
+#include "colors.h"
+
+#include <fileioc.h>
+#include <string.h>
+
+static const theme_t default_theme = {
+    .sky_day = COLOR_SKY_BLUE,
+    .sky_night = COLOR_NIGHT_SKY,
+    .cloud = COLOR_CLOUD_WHITE,
+    .grass = COLOR_GRASS_GREEN,
+    .grass_light = COLOR_GRASS_LIGHT,
+    .tree_trunk = COLOR_TREE_TRUNK,
+    .tree_leaves = COLOR_TREE_LEAVES,
+    .tree_light = COLOR_TREE_LIGHT,
+    .flower_red = COLOR_FLOWER_RED,
+    .flower_yellow = COLOR_FLOWER_YELLOW,
+    .flower_center = COLOR_FLOWER_CENTER,
+    .particle = COLOR_SNOW_WHITE,
+    .particle_outline = COLOR_GRAY,
+    .rain = COLOR_RAIN_BLUE,
+    .ground_y = GROUND_Y,
+    .snow_chance = 10,
+    .rain_chance = 10,
+    .particle_count = 18,
+    .fall_speed = 2,
+    .fall_range = 2,
+    .sprite_x = 0,
+    .sprite_y = 0,
+    .sprite_transparent = 0,
+};
+
+// Only one theme is ever decompressed, so RAM use doesn't grow with packs
+static uint8_t theme_buffer[THEME_DATA_MAX];
+static const theme_t *active_theme = &default_theme;
+static gfx_sprite_t *active_sprite = NULL;
+static char active_name[9] = "";
+static uint8_t active_month = 0;
+
+#define UNPACK_LITERALS     0
+#define UNPACK_LAST_OFFSET  1
+#define UNPACK_NEW_OFFSET   2
+
+// zx0 bit reader; error is set on any read past the end of the stream
+typedef struct {
+    const uint8_t *src;
+    uint16_t src_pos;
+    uint16_t src_len;
+    uint8_t bit_mask;
+    uint8_t bit_value;
+    uint8_t last_byte;
+    uint8_t backtrack;
+    uint8_t error;
+} unpack_t;
+
+static uint8_t unpack_byte(unpack_t *u)
+{
+    if (u->src_pos >= u->src_len) {
+        u->error = 1;
+        return 0;
+    }
+    u->last_byte = u->src[u->src_pos++];
+    return u->last_byte;
+}
+
+static uint8_t unpack_bit(unpack_t *u)
+{
+    // First length bit after a new offset is the offset byte's low bit
+    if (u->backtrack) {
+        u->backtrack = 0;
+        return u->last_byte & 1;
+    }
+    u->bit_mask >>= 1;
+    if (u->bit_mask == 0) {
+        u->bit_mask = 128;
+        u->bit_value = unpack_byte(u);
+    }
+    return (u->bit_value & u->bit_mask) ? 1 : 0;
+}
+
+// Interlaced Elias gamma code; anything bigger than the buffer is an error
+static uint16_t unpack_gamma(unpack_t *u, uint8_t inverted)
+{
+    uint16_t value = 1;
+
+    while (!unpack_bit(u)) {
+        if (u->error || value > THEME_DATA_MAX) {
+            u->error = 1;
+            return 0;
+        }
+        value = (value << 1) | (unpack_bit(u) ^ inverted);
+    }
+    return value;
+}
+
+// Copy a back-reference, refusing offsets before the start of the output
+static uint8_t unpack_copy(uint8_t *dst, uint16_t *out, uint16_t dst_len, uint16_t offset, uint16_t length)
+{
+    if (offset == 0 || offset > *out || length > dst_len - *out) {
+        return 0;
+    }
+    while (length--) {
+        dst[*out] = dst[*out - offset];
+        (*out)++;
+    }
+    return 1;
+}
+
+// Decode a zx0 stream into dst without writing past dst_len
+// Returns the decoded size, or 0 if the stream is malformed or too big
+static uint16_t unpack(uint8_t *dst, uint16_t dst_len, const uint8_t *src, uint16_t src_len)
+{
+    unpack_t u = { src, 0, src_len, 0, 0, 0, 0, 0 };
+    uint8_t state = UNPACK_LITERALS;
+    uint16_t out = 0;
+    uint16_t offset = 1;
+    uint16_t length;
+    uint16_t msb;
+
+    while (1) {
+        switch (state) {
+            case UNPACK_LITERALS:
+                length = unpack_gamma(&u, 0);
+                if (u.error || length > dst_len - out) {
+                    return 0;
+                }
+                while (length--) {
+                    dst[out++] = unpack_byte(&u);
+                }
+                state = unpack_bit(&u) ? UNPACK_NEW_OFFSET : UNPACK_LAST_OFFSET;
+                break;
+
+            case UNPACK_LAST_OFFSET:
+                length = unpack_gamma(&u, 0);
+                if (u.error || !unpack_copy(dst, &out, dst_len, offset, length)) {
+                    return 0;
+                }
+                state = unpack_bit(&u) ? UNPACK_NEW_OFFSET : UNPACK_LITERALS;
+                break;
+
+            case UNPACK_NEW_OFFSET:
+                msb = unpack_gamma(&u, 1);
+                if (u.error) {
+                    return 0;
+                }
+                if (msb == 256) {
+                    return out;  // End marker
+                }
+                if (msb > THEME_DATA_MAX / 128 + 1) {
+                    return 0;
+                }
+                offset = msb * 128 - (unpack_byte(&u) >> 1);
+                u.backtrack = 1;
+                length = unpack_gamma(&u, 0) + 1;
+                if (u.error || !unpack_copy(dst, &out, dst_len, offset, length)) {
+                    return 0;
+                }
+                state = unpack_bit(&u) ? UNPACK_NEW_OFFSET : UNPACK_LITERALS;
+                break;
+        }
+        if (u.error) {
+            return 0;
+        }
+    }
+}
+
+// Find the first installed pack covering the given month
+static char *find_pack(uint8_t month, const theme_header_t **header)
+{
+    void *search_pos = NULL;
+    char *name;
+
+    while ((name = ti_Detect(&search_pos, THEME_MAGIC)) != NULL) {
+        uint8_t handle = ti_Open(name, "r");
+        const theme_header_t *h;
+
+        if (!handle) {
+            continue;
+        }
+
+        h = ti_GetDataPtr(handle);
+        if (ti_GetSize(handle) > sizeof(theme_header_t) &&
+            ti_GetSize(handle) - sizeof(theme_header_t) == h->packed &&
+            h->version == THEME_VERSION &&
+            (h->months & (1 << (month - 1))) &&
+            h->size >= sizeof(theme_t) && h->size <= THEME_DATA_MAX) {
+            // Data pointer stays valid after closing; nothing is allocated in between
+            ti_Close(handle);
+            *header = h;
+            return name;
+        }
+        ti_Close(handle);
+    }
+    return NULL;
+}
+
+static void load_default(void)
+{
+    active_theme = &default_theme;
+    active_sprite = NULL;
+    active_name[0] = '\0';
+}
+
+uint8_t theme_update(uint8_t month)
+{
+    const theme_header_t *header;
+    theme_t *loaded;
+    char *name;
+
+    if (month == active_month) {
+        return 0;
+    }
+    active_month = month;
+
+    name = find_pack(month, &header);
+    if (name == NULL) {
+        if (active_name[0] == '\0') {
+            return 0;
+        }
+        load_default();
+        return 1;
+    }
+
+    // Same pack covers the new month, keep what is already in RAM
+    if (strcmp(name, active_name) == 0) {
+        return 0;
+    }
+
+    // A bad stream may have half-overwritten the previous pack, so fall
+    // back to the built-in theme rather than keep it
+    if (unpack(theme_buffer, THEME_DATA_MAX, (const uint8_t *)(header + 1), header->packed) != header->size) {
+        uint8_t had_pack = active_name[0] != '\0';
+        load_default();
+        return had_pack;
+    }
+
+    strcpy(active_name, name);
+    loaded = (theme_t *)theme_buffer;
+    active_theme = loaded;
+
+    // Keep the ground on screen and clear of the clock
+    if (loaded->ground_y < THEME_GROUND_MIN) {
+        loaded->ground_y = THEME_GROUND_MIN;
+    } else if (loaded->ground_y > THEME_GROUND_MAX) {
+        loaded->ground_y = THEME_GROUND_MAX;
+    }
+    active_sprite = NULL;
+
+    // Optional decoration sprite after the theme data
+    if (header->size > sizeof(theme_t) + 2) {
+        gfx_sprite_t *sprite = (gfx_sprite_t *)(theme_buffer + sizeof(theme_t));
+        if (sizeof(theme_t) + 2 + sprite->width * sprite->height <= header->size) {
+            active_sprite = sprite;
+        }
+    }
+    return 1;
+}
+
+const theme_t *theme_get(void)
+{
+    return active_theme;
+}
+
+int8_t theme_ground_offset(void)
+{
+    return (int16_t)active_theme->ground_y - GROUND_Y;
+}
+
+gfx_sprite_t *theme_sprite(void)
+{
+    return active_sprite;
+}
@@ -0,0 +1,68 @@
+// theme.h - Seasonal scene themes loaded from archived AppVar packs
+#ifndef THEME_H
+#define THEME_H
+
+#include <stdint.h>
+#include <graphx.h>
+
+// Pack AppVar layout: theme_header_t followed by zx0-compressed data.
+// The decompressed data is a theme_t, optionally followed by a sprite.
+// The stream is decoded with bounds checks, so a bad pack is rejected
+// rather than writing past the THEME_DATA_MAX theme buffer.
+typedef struct {
+    char magic[4];       // THEME_MAGIC (not nul-terminated)
+    uint8_t version;     // THEME_VERSION
+    uint16_t months;     // Bit n set = active in month n + 1
+    uint16_t size;       // Decompressed size in bytes
+    uint16_t packed;     // Compressed size in bytes (rest of the AppVar)
+} theme_header_t;
+
+typedef struct {
+    // Palette
+    uint8_t sky_day;
+    uint8_t sky_night;
+    uint8_t cloud;
+    uint8_t grass;
+    uint8_t grass_light;
+    uint8_t tree_trunk;
+    uint8_t tree_leaves;
+    uint8_t tree_light;
+    uint8_t flower_red;
+    uint8_t flower_yellow;
+    uint8_t flower_center;
+    uint8_t particle;
+    uint8_t particle_outline;
+    uint8_t rain;
+
+    // Background spans
+    uint8_t ground_y;    // Top of the ground strip (clamped to THEME_GROUND_MIN..MAX)
+
+    // Particles
+    uint8_t snow_chance;     // Percent
+    uint8_t rain_chance;     // Percent
+    uint8_t particle_count;  // Clamped to MAX_PARTICLES
+    uint8_t fall_speed;      // Minimum fall speed
+    uint8_t fall_range;      // Random extra fall speed (0 to fall_range)
+
+    // Decoration sprite position and see-through color index
+    // (sprite itself follows the theme_t)
+    int16_t sprite_x;
+    uint8_t sprite_y;
+    uint8_t sprite_transparent;
+} theme_t;
+
+// Select the theme pack for the given month (1-12), loading it if it changed
+// Returns 1 if the active theme changed
+uint8_t theme_update(uint8_t month);
+
+// Get the active theme (built-in default if no pack matches)
+const theme_t *theme_get(void);
+
+// Vertical shift of ground-relative scenery (trees, flowers, caterpillar)
+// from the built-in ground line
+int8_t theme_ground_offset(void);
+
+// Get the active theme's decoration sprite (NULL if none)
+gfx_sprite_t *theme_sprite(void);
+
+#endif
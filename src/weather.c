@@ -2,6 +2,7 @@
 #include "weather.h"
 #include "config.h"
 #include "colors.h"
+#include "theme.h"
 
 #include <graphx.h>
 #include <sys/rtc.h>
@@ -26,10 +27,11 @@ static uint8_t stars_initialized = 0;
 
 uint8_t weather_get_random_type(void)
 {
-    // RNG-based weather: 80% none, 10% snow, 10% rain
-    int r = simple_rand() % 10;
-    if (r == 0) return WEATHER_SNOW;
-    if (r == 1) return WEATHER_RAIN;
+    // RNG-based weather: odds come from the active theme (default 10% snow, 10% rain)
+    const theme_t *theme = theme_get();
+    int r = simple_rand() % 100;
+    if (r < theme->snow_chance) return WEATHER_SNOW;
+    if (r < theme->snow_chance + theme->rain_chance) return WEATHER_RAIN;
     return WEATHER_NONE;
 }
 
@@ -43,13 +45,21 @@ uint8_t stars_is_initialized(void)
     return stars_initialized;
 }
 
+// Number of particles to draw for the active theme
+static uint8_t particle_count(void)
+{
+    uint8_t count = theme_get()->particle_count;
+    return count > MAX_PARTICLES ? MAX_PARTICLES : count;
+}
+
 void weather_init(void)
 {
+    const theme_t *theme = theme_get();
     uint8_t i;
     for (i = 0; i < MAX_PARTICLES; i++) {
         particles[i].x = simple_rand() % SCREEN_WIDTH;
         particles[i].y = simple_rand() % SCREEN_HEIGHT;
-        particles[i].speed = 2 + (simple_rand() % 3);
+        particles[i].speed = theme->fall_speed + (simple_rand() % (theme->fall_range + 1));
         particles[i].drift = (simple_rand() % 3) - 1;
     }
     particles_initialized = 1;
@@ -83,18 +93,22 @@ void stars_draw(uint8_t frame)
     }
 }
 
-static void draw_snow(uint8_t frame)
+static void draw_snow(uint8_t frame, uint8_t advance)
 {
+    const theme_t *theme = theme_get();
+    uint8_t count = particle_count();
     uint8_t i;
     (void)frame;
 
-    for (i = 0; i < MAX_PARTICLES; i++) {
+    for (i = 0; i < count; i++) {
         // Draw snowflake as small filled circle
-        gfx_SetColor(COLOR_SNOW_WHITE);
+        gfx_SetColor(theme->particle);
         gfx_FillCircle(particles[i].x, particles[i].y, 2);
-        gfx_SetColor(COLOR_GRAY);
+        gfx_SetColor(theme->particle_outline);
         gfx_Circle(particles[i].x, particles[i].y, 2);
 
+        if (!advance) continue;
+
         // Update position - snow falls gently
         particles[i].y += particles[i].speed;
         particles[i].x += particles[i].drift;
@@ -109,17 +123,20 @@ static void draw_snow(uint8_t frame)
     }
 }
 
-static void draw_rain(uint8_t frame)
+static void draw_rain(uint8_t frame, uint8_t advance)
 {
+    uint8_t count = particle_count();
     uint8_t i;
     (void)frame;
 
-    gfx_SetColor(COLOR_RAIN_BLUE);
-    for (i = 0; i < MAX_PARTICLES; i++) {
+    gfx_SetColor(theme_get()->rain);
+    for (i = 0; i < count; i++) {
         // Draw raindrop as a line
         gfx_Line(particles[i].x, particles[i].y,
                  particles[i].x + 1, particles[i].y + 6);
 
+        if (!advance) continue;
+
         // Update position - rain falls fast
         particles[i].y += particles[i].speed + 3;
         particles[i].x += particles[i].drift;
@@ -134,10 +151,10 @@ static void draw_rain(uint8_t frame)
     }
 }
 
-void weather_draw(uint8_t weather_type, uint8_t frame)
+void weather_draw(uint8_t weather_type, uint8_t frame, uint8_t advance)
 {
     switch (weather_type) {
-        case WEATHER_SNOW: draw_snow(frame); break;
-        case WEATHER_RAIN: draw_rain(frame); break;
+        case WEATHER_SNOW: draw_snow(frame, advance); break;
+        case WEATHER_RAIN: draw_rain(frame, advance); break;
     }
 }
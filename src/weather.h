@@ -7,8 +7,8 @@
 // Initialize the weather/particle system
 void weather_init(void);
 
-// Draw weather effects (snow/rain)
-void weather_draw(uint8_t weather_type, uint8_t frame);
+// Draw weather effects (snow/rain), moving particles only if advance is set
+void weather_draw(uint8_t weather_type, uint8_t frame, uint8_t advance);
 
 // Get a random weather type
 uint8_t weather_get_random_type(void);
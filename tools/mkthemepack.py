@@ -0,0 +1,226 @@
+#!/usr/bin/env python3
+# mkthemepack.py - Build a CLOCK theme pack AppVar (.8xv) from a JSON file
+#
+# Usage: python3 tools/mkthemepack.py themes/winter.json WINTER.8xv
+#
+# The pack is a theme_header_t followed by a zx0 stream holding a theme_t
+# and an optional sprite (see src/theme.h). Send the .8xv to the calculator
+# and archive it; CLOCK picks it up in the months it lists.
+
+import json
+import struct
+import sys
+
+THEME_MAGIC = b"CLTH"
+THEME_VERSION = 1
+THEME_DATA_MAX = 4096
+THEME_GROUND_MIN = 200
+THEME_GROUND_MAX = 232
+MAX_PARTICLES = 36
+
+# theme_t fields in declaration order (eZ80: no padding, little endian)
+THEME_FIELDS = [
+    ("sky_day", "B"), ("sky_night", "B"), ("cloud", "B"), ("grass", "B"),
+    ("grass_light", "B"), ("tree_trunk", "B"), ("tree_leaves", "B"),
+    ("tree_light", "B"), ("flower_red", "B"), ("flower_yellow", "B"),
+    ("flower_center", "B"), ("particle", "B"), ("particle_outline", "B"),
+    ("rain", "B"),
+    ("ground_y", "B"),
+    ("snow_chance", "B"), ("rain_chance", "B"), ("particle_count", "B"),
+    ("fall_speed", "B"), ("fall_range", "B"),
+    ("sprite_x", "h"), ("sprite_y", "B"), ("sprite_transparent", "B"),
+]
+
+APPVAR_TYPE = 0x15
+
+
+class BitWriter:
+    """zx0 output: bit groups interleaved with literal/offset bytes."""
+
+    def __init__(self):
+        self.out = bytearray()
+        self.mask = 0
+        self.index = 0
+        self.backtrack = False
+
+    def byte(self, value):
+        self.out.append(value)
+
+    def bit(self, value):
+        # First length bit after a new offset goes in the offset byte's low bit
+        if self.backtrack:
+            if value:
+                self.out[-1] |= 1
+            self.backtrack = False
+            return
+        if self.mask == 0:
+            self.mask = 128
+            self.index = len(self.out)
+            self.out.append(0)
+        if value:
+            self.out[self.index] |= self.mask
+        self.mask >>= 1
+
+    def gamma(self, value, inverted=False):
+        # Interlaced Elias gamma: (0, bit) per bit below the top one, then 1
+        for b in bin(value)[3:]:
+            self.bit(0)
+            self.bit(int(b) ^ int(inverted))
+        self.bit(1)
+
+
+def match_length(data, pos, offset):
+    length = 0
+    while pos + length < len(data) and data[pos + length] == data[pos + length - offset]:
+        length += 1
+    return length
+
+
+def zx0_compress(data):
+    """Greedy zx0 encoder; output decodes with the unpacker in src/theme.c."""
+    blocks = []
+    literals = bytearray()
+    last_offset = 1
+    pos = 0
+
+    while pos < len(data):
+        best_len, best_off = 0, 0
+        for offset in range(1, pos + 1):
+            length = match_length(data, pos, offset)
+            if length > best_len:
+                best_len, best_off = length, offset
+        rep_len = match_length(data, pos, last_offset) if pos >= last_offset else 0
+
+        # A repeat-offset match may only follow literals
+        if literals and rep_len >= 1 and rep_len >= best_len:
+            blocks.append(("lit", bytes(literals)))
+            literals = bytearray()
+            blocks.append(("rep", rep_len))
+            pos += rep_len
+        elif best_len >= 2:
+            if literals:
+                blocks.append(("lit", bytes(literals)))
+                literals = bytearray()
+            blocks.append(("new", best_off, best_len))
+            last_offset = best_off
+            pos += best_len
+        else:
+            literals.append(data[pos])
+            pos += 1
+    if literals:
+        blocks.append(("lit", bytes(literals)))
+
+    w = BitWriter()
+    for i, block in enumerate(blocks):
+        if block[0] == "lit":
+            if i > 0:
+                w.bit(0)
+            w.gamma(len(block[1]))
+            for b in block[1]:
+                w.byte(b)
+        elif block[0] == "rep":
+            w.bit(0)
+            w.gamma(block[1])
+        else:
+            _, offset, length = block
+            w.bit(1)
+            w.gamma((offset - 1) // 128 + 1, inverted=True)
+            w.byte((127 - (offset - 1) % 128) << 1)
+            w.backtrack = True
+            w.gamma(length - 1)
+
+    # End marker
+    w.bit(1)
+    w.gamma(256, inverted=True)
+    return bytes(w.out)
+
+
+def build_sprite(spec):
+    rows = spec["rows"]
+    colors = spec["colors"]
+    width = len(rows[0])
+    if any(len(row) != width for row in rows):
+        raise ValueError("sprite rows must all be the same width")
+    if not 0 < width <= 255 or not 0 < len(rows) <= 255:
+        raise ValueError("sprite must be 1-255 pixels on each side")
+    pixels = bytearray([width, len(rows)])
+    for row in rows:
+        for ch in row:
+            pixels.append(colors[ch])
+    return bytes(pixels)
+
+
+def build_theme(spec):
+    values = dict(spec["theme"])
+    sprite = spec.get("sprite")
+    values.setdefault("sprite_x", sprite["x"] if sprite else 0)
+    values.setdefault("sprite_y", sprite["y"] if sprite else 0)
+    values.setdefault("sprite_transparent", sprite["transparent"] if sprite else 0)
+
+    missing = [name for name, _ in THEME_FIELDS if name not in values]
+    if missing:
+        raise ValueError("missing theme fields: " + ", ".join(missing))
+    if not THEME_GROUND_MIN <= values["ground_y"] <= THEME_GROUND_MAX:
+        raise ValueError("ground_y must be %d-%d" % (THEME_GROUND_MIN, THEME_GROUND_MAX))
+    if values["particle_count"] > MAX_PARTICLES:
+        raise ValueError("particle_count must be at most %d" % MAX_PARTICLES)
+    if values["snow_chance"] + values["rain_chance"] > 100:
+        raise ValueError("snow_chance + rain_chance must be at most 100")
+
+    fmt = "<" + "".join(f for _, f in THEME_FIELDS)
+    data = struct.pack(fmt, *(values[name] for name, _ in THEME_FIELDS))
+    if sprite:
+        data += build_sprite(sprite)
+    if len(data) > THEME_DATA_MAX:
+        raise ValueError("theme is %d bytes, limit is %d" % (len(data), THEME_DATA_MAX))
+    return data
+
+
+def build_pack(spec):
+    months = 0
+    for month in spec["months"]:
+        if not 1 <= month <= 12:
+            raise ValueError("months must be 1-12")
+        months |= 1 << (month - 1)
+
+    data = build_theme(spec)
+    packed = zx0_compress(data)
+    header = struct.pack("<4sBHHH", THEME_MAGIC, THEME_VERSION, months, len(data), len(packed))
+    return header + packed
+
+
+def write_8xv(path, name, content, archived=True):
+    name = name.upper().encode("ascii")
+    if not 1 <= len(name) <= 8 or not name[:1].isalpha():
+        raise ValueError("AppVar name must be 1-8 characters starting with a letter")
+
+    var_data = struct.pack("<H", len(content)) + content
+    entry = struct.pack("<HHB8sBBH", 0x0D, len(var_data), APPVAR_TYPE, name.ljust(8, b"\0"),
+                        0, 0x80 if archived else 0, len(var_data)) + var_data
+    comment = b"CLOCK theme pack".ljust(42, b"\0")
+    checksum = sum(entry) & 0xFFFF
+
+    with open(path, "wb") as f:
+        f.write(b"**TI83F*\x1a\x0a\x00" + comment + struct.pack("<H", len(entry)))
+        f.write(entry + struct.pack("<H", checksum))
+
+
+def main(argv):
+    if len(argv) != 3:
+        sys.stderr.write("usage: %s theme.json OUT.8xv\n" % argv[0])
+        return 1
+
+    with open(argv[1]) as f:
+        spec = json.load(f)
+    try:
+        pack = build_pack(spec)
+        write_8xv(argv[2], spec["name"], pack)
+    except (KeyError, ValueError) as e:
+        sys.stderr.write("%s: %s\n" % (argv[1], e))
+        return 1
+    print("%s: %s, %d bytes" % (argv[2], spec["name"].upper(), len(pack)))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))